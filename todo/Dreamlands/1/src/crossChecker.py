@@ -0,0 +1,194 @@
+import os
+from multiprocessing import Pool, cpu_count
+from re import search
+from subprocess import run
+from sys import argv, exit
+from time import perf_counter
+from passwordSolver import Problem, Solver
+EXIT_SUCCESS = 0
+EXIT_FAILURE = 1
+EOF = (-1)
+
+
+class Codec:
+	CodeCount = 4096
+	@staticmethod
+	def decode(code:int) -> tuple:
+		return (code >> 9 & 0x07, code >> 6 & 0x07, code >> 3 & 0x07, code & 0x07)
+	@staticmethod
+	def encode(results:tuple) -> int:
+		pattern = 0
+		for result in results:
+			pattern = pattern * 3 + result + 1
+		return pattern
+	@staticmethod
+	def toString(symbols:tuple) -> str:
+		return "".join(str(symbol) for symbol in symbols)
+	@staticmethod
+	def fromPattern(pattern:int) -> tuple:
+		return tuple(pattern // 3 ** (3 - idx) % 3 - 1 for idx in range(4))
+
+class Reference:
+	ChunkSize = 16 # Each task covers this many password rows. 
+	@staticmethod
+	def feedbackRow(code:int) -> str:
+		password, lineBuffer, problem = Codec.decode(code), [], Problem()
+		for submission in range(Codec.CodeCount):
+			problem.set(password)
+			isSubmitted, _, results = problem.submit(Codec.decode(submission))
+			lineBuffer.append("{0:02x}".format(Codec.encode(results)) if isSubmitted else "--")
+		return Codec.toString(password) + ": " + "".join(lineBuffer)
+	@staticmethod
+	def feedback(processCount:int) -> tuple:
+		startTime = perf_counter()
+		with Pool(processCount) as pool:
+			lines = pool.map(Reference.feedbackRow, range(Codec.CodeCount), chunksize = Reference.ChunkSize)
+		endTime = perf_counter()
+		return (lines, endTime - startTime)
+	@staticmethod
+	def solutions() -> tuple:
+		lines, problem = [], Problem()
+		startTime = perf_counter()
+		for code in range(Codec.CodeCount):
+			password = Codec.decode(code)
+			problem.set(password)
+			isValid, attemptCount, answers = Solver.solve(problem)
+			lines.append("{0}: {1} -> {2}".format(Codec.toString(password), attemptCount, (Codec.toString(answers) if isinstance(answers, tuple) else "Failed") if isValid else "Invalid"))
+		endTime = perf_counter()
+		return (lines, endTime - startTime)
+
+class Target:
+	def __init__(self:object, binaryPath:str) -> object:
+		self.__binaryPath = binaryPath
+	def __call(self:object, option:str, banner:str, pattern:str) -> tuple|None: # Only a missing banner aborts since a nonzero exit code may come from the very divergence to report. 
+		startTime = perf_counter()
+		completedProcess = run([self.__binaryPath, option], input = "\n", capture_output = True, text = True)
+		endTime = perf_counter()
+		if banner not in completedProcess.stdout:
+			print("The C++ implementation does not support ``{0}`` and may be too old. Please rebuild it. ".format(option))
+			return None
+		lines = completedProcess.stdout.splitlines()
+		lines = [line.rstrip() for line in lines if len(line) > 6 and line[:4].isdigit() and ": " == line[4:6]]
+		matcher = search(pattern, completedProcess.stdout)
+		return (lines, int(matcher.group(1)) / 1000000000 if matcher else float("nan"), endTime - startTime, completedProcess.returncode, completedProcess.stdout)
+	def feedback(self:object) -> tuple:
+		return self.__call("--feedback", "The program has entered the feedback mode. ", "evaluated \\d+ pairs in (\\d+) nanoseconds")
+	def solutions(self:object) -> tuple:
+		return self.__call("--solutions", "The program has entered the solution mode. ", "solved \\d+ groups in (\\d+) nanoseconds")
+	@staticmethod
+	def report(option:str, returnCode:int, output:str) -> None:
+		summaries = [line.strip() for line in output.splitlines() if line.startswith("The program has evaluated ") or line.startswith("The program has solved ")]
+		print("The C++ implementation exited with {0} under ``{1}``{2}".format(returnCode, option, ": " + summaries[-1] if summaries else " without a summary. "))
+
+class Checker:
+	MaximumReportCount = 16
+	@staticmethod
+	def compareFeedback(referenceLines:list, targetLines:list) -> int:
+		if len(referenceLines) != len(targetLines):
+			print("The line counts differ ({0} != {1}). ".format(len(referenceLines), len(targetLines)))
+			return max(len(referenceLines), len(targetLines)) * Codec.CodeCount
+		mismatchCount = 0
+		for referenceLine, targetLine in zip(referenceLines, targetLines):
+			if referenceLine != targetLine:
+				for submission in range(Codec.CodeCount):
+					referenceField, targetField = referenceLine[6 + (submission << 1):8 + (submission << 1)], targetLine[6 + (submission << 1):8 + (submission << 1)]
+					if referenceField != targetField:
+						mismatchCount += 1
+						if mismatchCount <= Checker.MaximumReportCount:
+							print(																	\
+								"Mismatch: password = {0}, submission = {1}, Python = {2}, C++ = {3}. ".format(				\
+									referenceLine[:4], Codec.toString(Codec.decode(submission)), Checker.__formatField(referenceField), Checker.__formatField(targetField)	\
+								)																\
+							)
+		return mismatchCount
+	@staticmethod
+	def compareSolutions(referenceLines:list, targetLines:list) -> int:
+		if len(referenceLines) != len(targetLines):
+			print("The line counts differ ({0} != {1}). ".format(len(referenceLines), len(targetLines)))
+			return max(len(referenceLines), len(targetLines))
+		mismatchCount = 0
+		for referenceLine, targetLine in zip(referenceLines, targetLines):
+			if referenceLine != targetLine:
+				mismatchCount += 1
+				if mismatchCount <= Checker.MaximumReportCount:
+					print("Mismatch: Python = \"{0}\", C++ = \"{1}\". ".format(referenceLine, targetLine))
+		return mismatchCount
+	@staticmethod
+	def __formatField(field:str) -> str:
+		try:
+			return str(Codec.fromPattern(int(field, 16)))
+		except:
+			return field
+
+class Helper:
+	@staticmethod
+	def printHelp() -> None:
+		print("This is a cross-checker comparing the C++ implementation against the Python reference implementation. \n")
+		print("1) If no options are passed, the program will look for the release build of the C++ implementation under ``./passwordSolver``. ")
+		print("2) If a path is passed, the program will use it as the C++ implementation. ")
+		print("3) Otherwise, this help information will display. \n")
+	@staticmethod
+	def findBinary() -> str|None:
+		folderPath = os.path.join(os.path.dirname(os.path.abspath(__file__)), "passwordSolver")
+		for relativePath in (("x64", "Release"), ("Release", ), ("x64", "Debug"), ("Debug", )):
+			binaryPath = os.path.join(folderPath, *relativePath, "passwordSolver.exe")
+			if os.path.isfile(binaryPath):
+				return binaryPath
+		return None
+	@staticmethod
+	def printTable(rows:list) -> None:
+		headers = ("Workload", "Python (s)", "C++ kernel (s)", "C++ process (s)", "Speedup (kernel)", "Speedup (process)")
+		cells = [headers] + [																		\
+			(workload, "{0:.6f}".format(pythonTime), "{0:.6f}".format(kernelTime), "{0:.6f}".format(processTime), "{0:.2f}x".format(pythonTime / kernelTime), "{0:.2f}x".format(pythonTime / processTime))	\
+			for workload, pythonTime, kernelTime, processTime in rows												\
+		]
+		widths = [max(len(row[idx]) for row in cells) for idx in range(len(headers))]
+		for row in cells:
+			print("| " + " | ".join(cell.ljust(width) for cell, width in zip(row, widths)) + " |")
+
+
+def main() -> int:
+	if 1 == len(argv):
+		binaryPath = Helper.findBinary()
+	elif 2 == len(argv) and os.path.isfile(argv[1]):
+		binaryPath = argv[1]
+	else:
+		binaryPath = None
+	if binaryPath is None:
+		Helper.printHelp()
+		return EOF
+	processCount = cpu_count()
+	print("The C++ implementation is located at \"{0}\", and the Python reference will run in {1} {2}. ".format(binaryPath, processCount, "processes" if processCount > 1 else "process"))
+	target, rows = Target(binaryPath), []
+
+	# Feedback #
+	targetResult = target.feedback()
+	if targetResult is None:
+		return EOF
+	targetLines, kernelTime, processTime, feedbackReturnCode, output = targetResult
+	Target.report("--feedback", feedbackReturnCode, output)
+	disagreementMatcher = search("(\\d+) pairs? disagreed", output)
+	disagreementCount = int(disagreementMatcher.group(1)) if disagreementMatcher else 0
+	referenceLines, pythonTime = Reference.feedback(processCount)
+	feedbackMismatchCount = Checker.compareFeedback(referenceLines, targetLines)
+	print("The feedback of {0} pairs has been compared, where {1} {2}. ".format(Codec.CodeCount * Codec.CodeCount, feedbackMismatchCount, "mismatches were found" if feedbackMismatchCount > 1 else "mismatch was found"))
+	rows.append(("Feedback ({0} pairs)".format(Codec.CodeCount * Codec.CodeCount), pythonTime, kernelTime, processTime))
+
+	# Solutions #
+	targetResult = target.solutions()
+	if targetResult is None:
+		return EOF
+	targetLines, kernelTime, processTime, solutionReturnCode, output = targetResult
+	Target.report("--solutions", solutionReturnCode, output)
+	referenceLines, pythonTime = Reference.solutions()
+	solutionMismatchCount = Checker.compareSolutions(referenceLines, targetLines)
+	print("The solutions of {0} groups have been compared, where {1} {2}. ".format(Codec.CodeCount, solutionMismatchCount, "mismatches were found" if solutionMismatchCount > 1 else "mismatch was found"))
+	rows.append(("Solver ({0} games)".format(Codec.CodeCount), pythonTime, kernelTime, processTime))
+
+	Helper.printTable(rows)
+	return EXIT_SUCCESS if 0 == feedbackMismatchCount == solutionMismatchCount == disagreementCount and EXIT_SUCCESS == feedbackReturnCode == solutionReturnCode else EXIT_FAILURE
+
+
+
+if "__main__" == __name__:
+	exit(main())
@@ -6,6 +6,53 @@
 #endif
 #include <random>
 #include <chrono>
+#include <cstdio>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <queue>
+#include <deque>
+#include <map>
+#include <memory>
+#include <array>
+#if defined _WIN32 || defined _WIN64 || defined WIN32 || defined WIN64
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <winsock2.h>
+#include <afunix.h>
+#pragma comment(lib, "ws2_32.lib")
+typedef SOCKET SocketHandle;
+typedef WSAPOLLFD PollDescriptor;
+typedef ULONG PollCount;
+#define CLOSE_SOCKET closesocket
+#define SHUTDOWN_BOTH SD_BOTH
+#define POLL WSAPoll
+#define IS_WOULD_BLOCK() (WSAEWOULDBLOCK == WSAGetLastError())
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+typedef int SocketHandle;
+typedef pollfd PollDescriptor;
+typedef nfds_t PollCount;
+#define INVALID_SOCKET (-1)
+#define CLOSE_SOCKET close
+#define SHUTDOWN_BOTH SHUT_RDWR
+#define POLL poll
+#define IS_WOULD_BLOCK() (EAGAIN == errno || EWOULDBLOCK == errno)
+#endif
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
 #ifndef EXIT_SUCCESS
 #define EXIT_SUCCESS 0 
 #endif
@@ -25,9 +72,20 @@
 #define TIME_POINT_TYPE std::chrono::system_clock::time_point
 #endif
 #endif
+#ifndef DEFAULT_SOCKET_PATH
+#if defined _WIN32 || defined _WIN64 || defined WIN32 || defined WIN64
+#define DEFAULT_SOCKET_PATH "passwordSolver.sock"
+#else
+#define DEFAULT_SOCKET_PATH "/tmp/passwordSolver.sock"
+#endif
+#endif
 typedef unsigned short Count;
+typedef unsigned short Code; // A password packed as 3 bits per symbol with the first symbol in the highest bits
+typedef unsigned char Pattern; // A result group packed as a base-3 number of (result + 1) with the first result as the highest digit
 constexpr const size_t PASSWORD_LENGTH = 4;
 constexpr const Count MAXIMUM_ATTEMPT_COUNT = 5;
+constexpr const Code CODE_COUNT = 4096;
+constexpr const Pattern PATTERN_COUNT = 81;
 
 
 enum class Symbol : unsigned char
@@ -59,6 +117,191 @@ enum class Result : char
 	Right = 1
 };
 
+static_assert(static_cast<unsigned char>(Symbol::RedStar) == 0 && static_cast<unsigned char>(Symbol::RedHeart) == 1 && static_cast<unsigned char>(Symbol::RedPawprint) == 2 && static_cast<unsigned char>(Symbol::RedBlossom) == 3, "The red symbols must be encoded as 0 to 3. ");
+static_assert(static_cast<unsigned char>(Symbol::BluePuzzle) == 4 && static_cast<unsigned char>(Symbol::BlueLeaf) == 5 && static_cast<unsigned char>(Symbol::BlueCrescent) == 6 && static_cast<unsigned char>(Symbol::BlueNote) == 7, "The blue symbols must be encoded as 4 to 7. ");
+static_assert(static_cast<char>(Result::Incorrect) + 1 == 0 && static_cast<char>(Result::Misplaced) + 1 == 1 && static_cast<char>(Result::Right) + 1 == 2, "The results must be encoded as the base-3 digits minus 1. ");
+static_assert(CODE_COUNT == 8 * 8 * 8 * 8 && CODE_COUNT == 1 << (3 * PASSWORD_LENGTH), "Each symbol must be packed into 3 bits. ");
+static_assert(PATTERN_COUNT == 3 * 3 * 3 * 3, "Each result must be packed into a base-3 digit. ");
+
+class Codec
+{
+public:
+	static Code encode(const std::vector<Symbol>& symbols)
+	{
+		Code code = 0;
+		for (const Symbol& symbol : symbols)
+			code = static_cast<Code>(code << 3 | static_cast<Code>(symbol));
+		return code;
+	}
+	static std::vector<Symbol> decode(const Code code)
+	{
+		std::vector<Symbol> symbols(PASSWORD_LENGTH);
+		for (size_t idx = 0; idx < PASSWORD_LENGTH; ++idx)
+			symbols[idx] = static_cast<Symbol>(code >> (3 * (PASSWORD_LENGTH - 1 - idx)) & 0x07);
+		return symbols;
+	}
+	static constexpr Code encode(const Symbol a, const Symbol b, const Symbol c, const Symbol d)
+	{
+		return static_cast<Code>(static_cast<Code>(a) << 9 | static_cast<Code>(b) << 6 | static_cast<Code>(c) << 3 | static_cast<Code>(d));
+	}
+	static constexpr Pattern encode(const Result a, const Result b, const Result c, const Result d)
+	{
+		return static_cast<Pattern>((static_cast<char>(a) + 1) * 27 + (static_cast<char>(b) + 1) * 9 + (static_cast<char>(c) + 1) * 3 + static_cast<char>(d) + 1);
+	}
+	static Pattern encode(const std::vector<Result>& results)
+	{
+		Pattern pattern = 0;
+		for (const Result& result : results)
+			pattern = static_cast<Pattern>(pattern * 3 + static_cast<char>(result) + 1);
+		return pattern;
+	}
+	static std::vector<Result> expand(const Pattern pattern)
+	{
+		std::vector<Result> results(PASSWORD_LENGTH);
+		Pattern remainingPattern = pattern;
+		for (size_t idx = PASSWORD_LENGTH; idx > 0; --idx)
+		{
+			results[idx - 1] = static_cast<Result>(remainingPattern % 3 - 1);
+			remainingPattern = static_cast<Pattern>(remainingPattern / 3);
+		}
+		return results;
+	}
+	static std::string toString(const Code code)
+	{
+		std::string stringBuffer(PASSWORD_LENGTH, '0');
+		for (size_t idx = 0; idx < PASSWORD_LENGTH; ++idx)
+			stringBuffer[idx] = static_cast<char>('0' + (code >> (3 * (PASSWORD_LENGTH - 1 - idx)) & 0x07));
+		return stringBuffer;
+	}
+};
+
+class LookupTable // The tables are generated at compile time and live in the read-only data. 
+{
+public:
+	static constexpr std::array<unsigned char, CODE_COUNT> buildRightMasks() // The index is ``password ^ submission`` and bit ``PASSWORD_LENGTH - 1 - idx`` marks a right position ``idx``. 
+	{
+		std::array<unsigned char, CODE_COUNT> rightMasks{};
+		for (size_t difference = 0; difference < CODE_COUNT; ++difference)
+			for (size_t idx = 0; idx < PASSWORD_LENGTH; ++idx)
+				if (!(difference >> (3 * (PASSWORD_LENGTH - 1 - idx)) & 0x07))
+					rightMasks[difference] = static_cast<unsigned char>(rightMasks[difference] | 1 << (PASSWORD_LENGTH - 1 - idx));
+		return rightMasks;
+	}
+	static constexpr std::array<Code, 1 << PASSWORD_LENGTH> buildRightCodeMasks() // The index is a right mask and the value keeps the symbol bits of the right positions. 
+	{
+		std::array<Code, 1 << PASSWORD_LENGTH> rightCodeMasks{};
+		for (size_t rightMask = 0; rightMask < rightCodeMasks.size(); ++rightMask)
+			for (size_t shift = 0; shift < PASSWORD_LENGTH; ++shift)
+				if (rightMask >> shift & 1)
+					rightCodeMasks[rightMask] = static_cast<Code>(rightCodeMasks[rightMask] | 0x07 << (3 * shift));
+		return rightCodeMasks;
+	}
+	static constexpr std::array<unsigned char, 1 << PASSWORD_LENGTH> buildRightCounts()
+	{
+		std::array<unsigned char, 1 << PASSWORD_LENGTH> rightCounts{};
+		for (size_t rightMask = 0; rightMask < rightCounts.size(); ++rightMask)
+			for (size_t shift = 0; shift < PASSWORD_LENGTH; ++shift)
+				rightCounts[rightMask] = static_cast<unsigned char>(rightCounts[rightMask] + (rightMask >> shift & 1));
+		return rightCounts;
+	}
+	static constexpr std::array<Pattern, 1 << PASSWORD_LENGTH> buildRightPatterns() // The index is a right mask and the value marks the other positions as incorrect. 
+	{
+		std::array<Pattern, 1 << PASSWORD_LENGTH> rightPatterns{};
+		for (size_t rightMask = 0; rightMask < rightPatterns.size(); ++rightMask)
+		{
+			Pattern weight = 1;
+			for (size_t shift = 0; shift < PASSWORD_LENGTH; ++shift)
+			{
+				if (rightMask >> shift & 1)
+					rightPatterns[rightMask] = static_cast<Pattern>(rightPatterns[rightMask] + weight * (static_cast<char>(Result::Right) + 1));
+				weight = static_cast<Pattern>(weight * 3);
+			}
+		}
+		return rightPatterns;
+	}
+	static constexpr std::array<unsigned int, CODE_COUNT> buildSymbolCounts() // The count of symbol ``s`` in a code takes the 4 bits starting from bit ``4 * s``. 
+	{
+		std::array<unsigned int, CODE_COUNT> symbolCounts{};
+		for (size_t code = 0; code < CODE_COUNT; ++code)
+			for (size_t shift = 0; shift < PASSWORD_LENGTH; ++shift)
+				symbolCounts[code] += 1U << ((code >> (3 * shift) & 0x07) << 2);
+		return symbolCounts;
+	}
+};
+
+constexpr const std::array<unsigned char, CODE_COUNT> RIGHT_MASKS = LookupTable::buildRightMasks();
+constexpr const std::array<Code, 1 << PASSWORD_LENGTH> RIGHT_CODE_MASKS = LookupTable::buildRightCodeMasks();
+constexpr const std::array<unsigned char, 1 << PASSWORD_LENGTH> RIGHT_COUNTS = LookupTable::buildRightCounts();
+constexpr const std::array<Pattern, 1 << PASSWORD_LENGTH> RIGHT_PATTERNS = LookupTable::buildRightPatterns();
+constexpr const std::array<Pattern, PASSWORD_LENGTH> MISPLACED_WEIGHTS = { 1, 3, 9, 27 };
+constexpr const std::array<unsigned int, CODE_COUNT> SYMBOL_COUNTS = LookupTable::buildSymbolCounts();
+
+class Feedback
+{
+public:
+	static constexpr Pattern evaluateDirectly(const Code password, const Code submission) // This follows the documented rule step by step and serves as the reference of ``evaluate``. 
+	{
+		unsigned char remainingCounts[8] = { 0 };
+		bool rightFlags[PASSWORD_LENGTH] = { false };
+		for (size_t idx = 0; idx < PASSWORD_LENGTH; ++idx)
+		{
+			const size_t shift = 3 * (PASSWORD_LENGTH - 1 - idx);
+			if ((password >> shift & 0x07) == (submission >> shift & 0x07))
+				rightFlags[idx] = true;
+			else
+				++remainingCounts[password >> shift & 0x07];
+		}
+		Pattern pattern = 0;
+		for (size_t idx = 0; idx < PASSWORD_LENGTH; ++idx)
+		{
+			const size_t symbol = submission >> (3 * (PASSWORD_LENGTH - 1 - idx)) & 0x07;
+			Result result = Result::Incorrect;
+			if (rightFlags[idx])
+				result = Result::Right;
+			else if (remainingCounts[symbol])
+			{
+				result = Result::Misplaced;
+				--remainingCounts[symbol];
+			}
+			pattern = static_cast<Pattern>(pattern * 3 + static_cast<char>(result) + 1);
+		}
+		return pattern;
+	}
+	static constexpr Pattern evaluate(const Code password, const Code submission) // This reads the generated tables and backs ``Problem::submit``. 
+	{
+		const unsigned char rightMask = RIGHT_MASKS[password ^ submission];
+		unsigned int remainingCounts = SYMBOL_COUNTS[password] + static_cast<unsigned int>(PASSWORD_LENGTH - RIGHT_COUNTS[rightMask]) - SYMBOL_COUNTS[password & RIGHT_CODE_MASKS[rightMask]]; // The masked positions read as symbol 0 and are compensated. 
+		Pattern pattern = RIGHT_PATTERNS[rightMask];
+		for (size_t idx = 0; idx < PASSWORD_LENGTH; ++idx)
+		{
+			const size_t shift = PASSWORD_LENGTH - 1 - idx;
+			if (!(rightMask >> shift & 1))
+			{
+				const size_t countShift = static_cast<size_t>(submission >> (3 * shift) & 0x07) << 2;
+				if (remainingCounts >> countShift & 0x0F)
+				{
+					remainingCounts -= 1U << countShift;
+					pattern = static_cast<Pattern>(pattern + MISPLACED_WEIGHTS[shift]);
+				}
+			}
+		}
+		return pattern;
+	}
+	static constexpr bool isConsistent(const Code password) // This compares both implementations over all the submissions against a password. 
+	{
+		for (size_t submission = 0; submission < CODE_COUNT; ++submission)
+			if (Feedback::evaluate(password, static_cast<Code>(submission)) != Feedback::evaluateDirectly(password, static_cast<Code>(submission)))
+				return false;
+		return true;
+	}
+};
+
+static_assert(RIGHT_MASKS[0] == 0x0F && RIGHT_MASKS[CODE_COUNT - 1] == 0x00 && RIGHT_CODE_MASKS[0x0F] == CODE_COUNT - 1 && RIGHT_PATTERNS[0x0F] == PATTERN_COUNT - 1, "The right masks are malformed. ");
+static_assert(SYMBOL_COUNTS[Codec::encode(Symbol::RedHeart, Symbol::RedHeart, Symbol::RedPawprint, Symbol::RedPawprint)] == 0x00000220, "The symbol counts are malformed. ");
+static_assert(Feedback::evaluateDirectly(Codec::encode(Symbol::RedHeart, Symbol::RedHeart, Symbol::RedPawprint, Symbol::RedPawprint), Codec::encode(Symbol::RedPawprint, Symbol::RedPawprint, Symbol::RedBlossom, Symbol::RedPawprint)) == Codec::encode(Result::Misplaced, Result::Incorrect, Result::Incorrect, Result::Right), "The documented example of (1, 1, 2, 2) and (2, 2, 3, 2) must yield (0, -1, -1, 1). ");
+static_assert(Feedback::evaluate(Codec::encode(Symbol::RedHeart, Symbol::RedHeart, Symbol::RedPawprint, Symbol::RedPawprint), Codec::encode(Symbol::RedPawprint, Symbol::RedPawprint, Symbol::RedBlossom, Symbol::RedPawprint)) == Codec::encode(Result::Misplaced, Result::Incorrect, Result::Incorrect, Result::Right), "The documented example of (1, 1, 2, 2) and (2, 2, 3, 2) must yield (0, -1, -1, 1). ");
+static_assert(Feedback::isConsistent(Codec::encode(Symbol::RedHeart, Symbol::RedHeart, Symbol::RedPawprint, Symbol::RedPawprint)), "The table-driven feedback must agree with the documented rule. ");
+
 class Problem
 {
 private:
@@ -67,6 +310,16 @@ private:
 	Count remainingAttemptCount = MAXIMUM_ATTEMPT_COUNT;
 	Status status = Status::Initialized;
 	
+	static bool isValid(const std::vector<Symbol>& group) // Only valid symbols can be packed into a code below ``CODE_COUNT``. 
+	{
+		if (group.size() != PASSWORD_LENGTH)
+			return false;
+		for (const Symbol& symbol : group)
+			if (symbol > Symbol::BlueNote)
+				return false;
+		return true;
+	}
+	
 public:
 	Problem()
 	{
@@ -86,7 +339,7 @@ public:
 	}
 	bool set(const std::vector<Symbol>& group)
 	{
-		if (group.size() == PASSWORD_LENGTH)
+		if (Problem::isValid(group))
 		{
 			this->symbols = group;
 			this->remainingAttemptCount = MAXIMUM_ATTEMPT_COUNT;
@@ -102,31 +355,12 @@ public:
 	}
 	bool submit(const std::vector<Symbol>& submissions, Status& s, std::vector<Result>& results)
 	{
-		if (Status::Generated <= this->status && this->status <= Status::Solving && this->remainingAttemptCount >= 1 && submissions.size() == PASSWORD_LENGTH)
+		if (Status::Generated <= this->status && this->status <= Status::Solving && this->remainingAttemptCount >= 1 && Problem::isValid(submissions))
 		{
-			results = std::vector<Result>(PASSWORD_LENGTH, Result::Incorrect);
-			Count rightPositionCount = 0;
-			std::vector<Symbol> remainingSymbols{};
-			for (size_t idx = 0; idx < PASSWORD_LENGTH; ++idx)
-				if (submissions[idx] == this->symbols[idx])
-				{
-					results[idx] = Result::Right;
-					++rightPositionCount;
-				}
-				else
-					remainingSymbols.push_back(this->symbols[idx]);
-			for (size_t idx = 0; idx < PASSWORD_LENGTH; ++idx)
-				if (results[idx] != Result::Right)
-				{
-					std::vector<Symbol>::iterator it = std::find(remainingSymbols.begin(), remainingSymbols.end(), submissions[idx]);
-					if (it != remainingSymbols.end())
-					{
-						results[idx] = Result::Misplaced;
-						remainingSymbols.erase(it);
-					}
-				}
+			const Pattern pattern = Feedback::evaluate(Codec::encode(this->symbols), Codec::encode(submissions));
+			results = Codec::expand(pattern);
 			--this->remainingAttemptCount;
-			this->status = rightPositionCount >= PASSWORD_LENGTH ? Status::Successful : (this->remainingAttemptCount < 1 ? Status::Failed : Status::Solving);
+			this->status = PATTERN_COUNT - 1 == pattern ? Status::Successful : (this->remainingAttemptCount < 1 ? Status::Failed : Status::Solving);
 			s = this->status;
 			return true;
 		}
@@ -139,6 +373,103 @@ public:
 	}
 };
 
+class FeedbackTable // This is immutable after construction and can be shared by threads without locking. 
+{
+private:
+	std::vector<Pattern> patterns{}; // The row of a submission holds its patterns against all the passwords. 
+	Code openingSubmission = 0;
+	
+public:
+	FeedbackTable(); // This is defined after ``Solver`` which picks the opening submission. 
+	const Pattern* getRow(const Code submission) const // The row holds ``CODE_COUNT`` patterns indexed by the password. 
+	{
+		return this->patterns.data() + static_cast<size_t>(submission) * CODE_COUNT;
+	}
+	Pattern get(const Code password, const Code submission) const
+	{
+		return this->patterns[static_cast<size_t>(submission) * CODE_COUNT + password];
+	}
+	Code getOpeningSubmission() const
+	{
+		return this->openingSubmission;
+	}
+};
+
+class Histogram
+{
+public:
+	typedef std::array<Count, PATTERN_COUNT> Bins;
+	static constexpr const size_t SUBMISSION_TILE_SIZE = 32; // A tile is the unit handed to a thread, so each thread writes its own histograms. 
+	
+private:
+	static void computeTile(const Code* const submissions, const size_t submissionCount, const std::vector<Code>& passwords, Bins* const histograms, const FeedbackTable* const table)
+	{
+		const size_t passwordCount = passwords.size();
+		for (size_t submissionIdx = 0; submissionIdx < submissionCount; ++submissionIdx)
+		{
+			const Code submission = submissions[submissionIdx];
+			Count* const bins = histograms[submissionIdx].data();
+			if (table)
+			{
+				const Pattern* const row = table->getRow(submission);
+				for (size_t passwordIdx = 0; passwordIdx < passwordCount; ++passwordIdx)
+					++bins[row[passwords[passwordIdx]]];
+			}
+			else
+				for (size_t passwordIdx = 0; passwordIdx < passwordCount; ++passwordIdx)
+					++bins[Feedback::evaluate(passwords[passwordIdx], submission)];
+		}
+		return;
+	}
+	
+public:
+	static bool compute(const std::vector<Code>& submissions, const std::vector<Code>& passwords, std::vector<Bins>& histograms, const size_t threadCount = 0, const FeedbackTable* const table = nullptr) // A zero thread count uses all the hardware threads, and the optional table replaces the evaluation. 
+	{
+		if (passwords.size() > static_cast<Count>(~0U))
+		{
+			histograms.clear();
+			return false;
+		}
+		for (const std::vector<Code>* const codes : { &submissions, &passwords })
+			for (const Code& code : *codes)
+				if (code >= CODE_COUNT)
+				{
+					histograms.clear();
+					return false;
+				}
+		histograms.assign(submissions.size(), Bins{});
+		const size_t tileCount = (submissions.size() + SUBMISSION_TILE_SIZE - 1) / SUBMISSION_TILE_SIZE;
+		size_t workerCount = threadCount ? threadCount : (std::thread::hardware_concurrency() >= 1 ? std::thread::hardware_concurrency() : 1);
+		if (workerCount > tileCount)
+			workerCount = tileCount;
+		std::atomic<size_t> nextTile{ 0 };
+		const auto work = [&submissions, &passwords, &histograms, &nextTile, tileCount, table]()
+		{
+			for (size_t tile = nextTile++; tile < tileCount; tile = nextTile++)
+			{
+				const size_t submissionStart = tile * SUBMISSION_TILE_SIZE;
+				const size_t submissionCount = submissionStart + SUBMISSION_TILE_SIZE < submissions.size() ? SUBMISSION_TILE_SIZE : submissions.size() - submissionStart;
+				Histogram::computeTile(submissions.data() + submissionStart, submissionCount, passwords, histograms.data() + submissionStart, table);
+			}
+		};
+		std::vector<std::thread> workers{};
+		for (size_t idx = 1; idx < workerCount; ++idx)
+			workers.emplace_back(work);
+		work();
+		for (std::thread& worker : workers)
+			worker.join();
+		return true;
+	}
+	static Count getLargestBin(const Bins& bins)
+	{
+		Count largestBin = 0;
+		for (const Count& bin : bins)
+			if (bin > largestBin)
+				largestBin = bin;
+		return largestBin;
+	}
+};
+
 #if defined _DEBUG || defined DEBUG
 class Formatter
 {
@@ -334,6 +665,25 @@ private:
 	}
 	
 public:
+	static bool getMinimaxSubmission(const std::vector<Code>& candidates, Code& submission, const size_t threadCount = 0, const FeedbackTable* const table = nullptr) // The candidate minimizing its largest pattern class wins and the smallest index breaks ties. 
+	{
+		std::vector<Histogram::Bins> histograms{};
+		if (candidates.empty() || !Histogram::compute(candidates, candidates, histograms, threadCount, table))
+			return false;
+		size_t bestIdx = 0;
+		Count bestLargestBin = Histogram::getLargestBin(histograms[0]);
+		for (size_t idx = 1; idx < histograms.size(); ++idx)
+		{
+			const Count largestBin = Histogram::getLargestBin(histograms[idx]);
+			if (largestBin < bestLargestBin)
+			{
+				bestIdx = idx;
+				bestLargestBin = largestBin;
+			}
+		}
+		submission = candidates[bestIdx];
+		return true;
+	}
 	static bool solve(Problem& problem, Count& attemptCount, std::vector<Symbol>& symbols)
 	{
 		Status status = problem.getStatus();
@@ -518,6 +868,537 @@ public:
 	}
 };
 
+FeedbackTable::FeedbackTable() : patterns(static_cast<size_t>(CODE_COUNT) * CODE_COUNT)
+{
+	for (Code submission = 0; submission < CODE_COUNT; ++submission)
+	{
+		Pattern* const row = this->patterns.data() + static_cast<size_t>(submission) * CODE_COUNT;
+		for (Code password = 0; password < CODE_COUNT; ++password)
+			row[password] = Feedback::evaluate(password, submission);
+	}
+	std::vector<Code> passwords(CODE_COUNT);
+	for (Code code = 0; code < CODE_COUNT; ++code)
+		passwords[code] = code;
+	Solver::getMinimaxSubmission(passwords, this->openingSubmission, 0, this);
+}
+
+class Advisor // Each connection owns an advisor narrowing down the passwords consistent with the reported results. 
+{
+private:
+	const FeedbackTable& table;
+	std::vector<Code> candidates{};
+	
+public:
+	Advisor(const FeedbackTable& feedbackTable) : table(feedbackTable)
+	{
+		this->reset();
+	}
+	size_t reset()
+	{
+		this->candidates = std::vector<Code>(CODE_COUNT);
+		for (Code code = 0; code < CODE_COUNT; ++code)
+			this->candidates[code] = code;
+		return this->candidates.size();
+	}
+	size_t update(const Code submission, const Pattern pattern)
+	{
+		std::vector<Code> remainingCandidates{};
+		for (const Code& password : this->candidates)
+			if (this->table.get(password, submission) == pattern)
+				remainingCandidates.push_back(password);
+		this->candidates.swap(remainingCandidates);
+		return this->candidates.size();
+	}
+	bool suggest(Code& submission) const
+	{
+		if (CODE_COUNT == this->candidates.size())
+		{
+			submission = this->table.getOpeningSubmission();
+			return true;
+		}
+		else
+			return Solver::getMinimaxSubmission(this->candidates, submission, 1, &this->table); // The connections already run in parallel. 
+	}
+};
+
+class LatencyHistogram // Each power of 2 is split into 4 buckets, so a reported percentile overestimates by at most 25%. 
+{
+public:
+	static constexpr const size_t SUB_BUCKET_BITS = 2;
+	static constexpr const size_t BUCKET_COUNT = 64 << SUB_BUCKET_BITS;
+	
+private:
+	std::array<std::atomic<unsigned long long int>, BUCKET_COUNT> counts;
+	std::atomic<unsigned long long int> maximum{ 0 };
+	
+	static size_t getBucket(const unsigned long long int value)
+	{
+		if (value < (1ULL << SUB_BUCKET_BITS))
+			return static_cast<size_t>(value);
+		size_t exponent = SUB_BUCKET_BITS;
+		while (value >> (exponent + 1))
+			++exponent;
+		return ((exponent - SUB_BUCKET_BITS + 1) << SUB_BUCKET_BITS) + static_cast<size_t>(value >> (exponent - SUB_BUCKET_BITS) & ((1ULL << SUB_BUCKET_BITS) - 1));
+	}
+	static unsigned long long int getUpperBound(const size_t bucket)
+	{
+		if (bucket < (1ULL << SUB_BUCKET_BITS))
+			return bucket;
+		const size_t exponent = (bucket >> SUB_BUCKET_BITS) + SUB_BUCKET_BITS - 1;
+		const unsigned long long int lowerBound = static_cast<unsigned long long int>((1ULL << SUB_BUCKET_BITS) + (bucket & ((1ULL << SUB_BUCKET_BITS) - 1))) << (exponent - SUB_BUCKET_BITS);
+		return lowerBound + (1ULL << (exponent - SUB_BUCKET_BITS)) - 1;
+	}
+	
+public:
+	LatencyHistogram()
+	{
+		for (std::atomic<unsigned long long int>& count : this->counts)
+			count.store(0);
+	}
+	void record(const long long int nanoseconds)
+	{
+		const unsigned long long int value = nanoseconds > 0 ? static_cast<unsigned long long int>(nanoseconds) : 0;
+		this->counts[LatencyHistogram::getBucket(value)].fetch_add(1, std::memory_order_relaxed);
+		unsigned long long int currentMaximum = this->maximum.load(std::memory_order_relaxed);
+		while (value > currentMaximum && !this->maximum.compare_exchange_weak(currentMaximum, value, std::memory_order_relaxed));
+		return;
+	}
+	std::string summarize() const
+	{
+		std::array<unsigned long long int, BUCKET_COUNT> snapshot{};
+		unsigned long long int count = 0;
+		for (size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket)
+			count += snapshot[bucket] = this->counts[bucket].load(std::memory_order_relaxed);
+		if (!count)
+			return "count=0";
+		const unsigned long long int currentMaximum = this->maximum.load(std::memory_order_relaxed);
+		const auto percentile = [&snapshot, count, currentMaximum](const unsigned long long int rank) // This is the nearest-rank percentile. 
+		{
+			const unsigned long long int target = (count * rank + 99) / 100;
+			unsigned long long int cumulativeCount = 0;
+			for (size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket)
+				if ((cumulativeCount += snapshot[bucket]) >= target)
+					return std::to_string(LatencyHistogram::getUpperBound(bucket) < currentMaximum ? LatencyHistogram::getUpperBound(bucket) : currentMaximum);
+			return std::to_string(currentMaximum);
+		};
+		return "count=" + std::to_string(count) + " p50=" + percentile(50) + " p90=" + percentile(90) + " p99=" + percentile(99) + " max=" + std::to_string(currentMaximum) + " (nanoseconds)";
+	}
+};
+
+class Server
+{
+public:
+	static constexpr const size_t MAXIMUM_LINE_LENGTH = 1024;
+	static constexpr const size_t MAXIMUM_PENDING_LINE_COUNT = 4096;
+	static constexpr const size_t PAUSING_LINE_COUNT = 1024; // The polling thread stops reading from a connection with this many unanswered lines. 
+	static constexpr const size_t MAXIMUM_SENDING_LENGTH = 65536; // The workers stop answering and the polling thread stops reading beyond this many unsent bytes. 
+	static constexpr const size_t BATCH_LINE_COUNT = 16; // A worker hands a connection back to the queue after answering this many lines. 
+	
+private:
+	struct Connection // The advisor belongs to the scheduled worker while the other fields are guarded by the mutex. 
+	{
+		const SocketHandle clientSocket;
+		Advisor advisor;
+		std::string receivingBuffer{};
+		std::deque<std::pair<std::string, TIME_POINT_TYPE>> pendingLines{};
+		std::string sendingBuffer{};
+		std::mutex mutex{};
+		bool isScheduled = false;
+		bool isClosing = false;
+		
+		Connection(const SocketHandle socketHandle, const FeedbackTable& feedbackTable) : clientSocket(socketHandle), advisor(feedbackTable)
+		{
+			
+		}
+	};
+	
+	const FeedbackTable& table;
+	const std::string socketPath;
+	SocketHandle listeningSocket = INVALID_SOCKET;
+	std::atomic<bool> isStopping{ false };
+	std::map<SocketHandle, std::shared_ptr<Connection>> connections{};
+	std::queue<std::shared_ptr<Connection>> scheduledConnections{};
+	std::mutex queueMutex{};
+	std::condition_variable queueCondition{};
+	LatencyHistogram latencies{};
+	
+	static bool parseCode(const std::string& token, Code& code)
+	{
+		if (token.size() != PASSWORD_LENGTH)
+			return false;
+		code = 0;
+		for (const char& ch : token)
+			if ('0' <= ch && ch <= '7')
+				code = static_cast<Code>(code << 3 | (ch - '0'));
+			else
+				return false;
+		return true;
+	}
+	static bool parsePattern(const std::vector<std::string>& tokens, const size_t offset, Pattern& pattern)
+	{
+		if (tokens.size() != offset + PASSWORD_LENGTH)
+			return false;
+		pattern = 0;
+		for (size_t idx = offset; idx < tokens.size(); ++idx)
+			if ("-1" == tokens[idx] || "0" == tokens[idx] || "1" == tokens[idx])
+				pattern = static_cast<Pattern>(pattern * 3 + std::stoi(tokens[idx]) + 1);
+			else
+				return false;
+		return true;
+	}
+	static std::string formatPattern(const Pattern pattern)
+	{
+		std::string stringBuffer{};
+		for (size_t idx = 0; idx < PASSWORD_LENGTH; ++idx)
+		{
+			Pattern divisor = 1;
+			for (size_t exponent = idx + 1; exponent < PASSWORD_LENGTH; ++exponent)
+				divisor *= 3;
+			stringBuffer += (idx ? " " : "") + std::to_string(pattern / divisor % 3 - 1);
+		}
+		return stringBuffer;
+	}
+	static bool setNonBlocking(const SocketHandle socketHandle)
+	{
+#if defined _WIN32 || defined _WIN64 || defined WIN32 || defined WIN64
+		u_long isNonBlocking = 1;
+		return !ioctlsocket(socketHandle, FIONBIO, &isNonBlocking);
+#else
+		const int flags = fcntl(socketHandle, F_GETFL, 0);
+		return flags >= 0 && !fcntl(socketHandle, F_SETFL, flags | O_NONBLOCK);
+#endif
+	}
+	static bool flush(Connection& connection) // The caller holds the mutex, and the socket never blocks. 
+	{
+		while (!connection.sendingBuffer.empty())
+		{
+			const int length = send(connection.clientSocket, connection.sendingBuffer.data(), static_cast<int>(connection.sendingBuffer.size() < MAXIMUM_SENDING_LENGTH ? connection.sendingBuffer.size() : MAXIMUM_SENDING_LENGTH), MSG_NOSIGNAL);
+			if (length > 0)
+				connection.sendingBuffer.erase(0, static_cast<size_t>(length));
+			else
+				return length < 0 && IS_WOULD_BLOCK(); // The rest is sent once the polling thread sees ``POLLOUT``. 
+		}
+		return true;
+	}
+	static void drop(Connection& connection) // The caller holds the mutex. 
+	{
+		connection.pendingLines.clear();
+		connection.sendingBuffer.clear();
+		connection.isClosing = true;
+		shutdown(connection.clientSocket, SHUTDOWN_BOTH); // Any later reply of a running worker fails and is discarded. 
+		return;
+	}
+	std::string handle(const std::string& line, Advisor& advisor, bool& isClosing)
+	{
+		std::vector<std::string> tokens{};
+		size_t start = line.find_first_not_of(' ');
+		while (start != std::string::npos)
+		{
+			const size_t end = line.find(' ', start);
+			tokens.push_back(line.substr(start, end == std::string::npos ? std::string::npos : end - start));
+			start = end == std::string::npos ? end : line.find_first_not_of(' ', end);
+		}
+		if (tokens.empty())
+			return "ERROR empty request";
+		Code password = 0, submission = 0;
+		Pattern pattern = 0;
+		if ("SUBMIT" == tokens[0])
+			return 3 == tokens.size() && Server::parseCode(tokens[1], password) && Server::parseCode(tokens[2], submission) ? "OK " + Server::formatPattern(this->table.get(password, submission)) : "ERROR usage: SUBMIT <password> <submission>";
+		else if ("RESET" == tokens[0])
+			return "OK " + std::to_string(advisor.reset());
+		else if ("UPDATE" == tokens[0])
+			return tokens.size() >= 2 && Server::parseCode(tokens[1], submission) && Server::parsePattern(tokens, 2, pattern) ? "OK " + std::to_string(advisor.update(submission, pattern)) : "ERROR usage: UPDATE <submission> <result> <result> <result> <result>";
+		else if ("SUGGEST" == tokens[0])
+			return advisor.suggest(submission) ? "OK " + Codec::toString(submission) : "ERROR no candidates";
+		else if ("STATS" == tokens[0])
+			return "OK " + this->getStatistics();
+		else if ("QUIT" == tokens[0])
+		{
+			isClosing = true;
+			return "OK";
+		}
+		else if ("SHUTDOWN" == tokens[0])
+		{
+			isClosing = true;
+			this->isStopping = true;
+			return "OK";
+		}
+		else
+			return "ERROR unknown request";
+	}
+	void schedule(const std::shared_ptr<Connection>& connection)
+	{
+		std::lock_guard<std::mutex> lock(this->queueMutex);
+		this->scheduledConnections.push(connection);
+		this->queueCondition.notify_one();
+		return;
+	}
+	void resume(const std::shared_ptr<Connection>& connection) // The caller holds the mutex of the connection. 
+	{
+		if (!connection->isScheduled && !connection->pendingLines.empty() && connection->sendingBuffer.size() < MAXIMUM_SENDING_LENGTH)
+		{
+			connection->isScheduled = true;
+			this->schedule(connection);
+		}
+		return;
+	}
+	void serve(const std::shared_ptr<Connection>& connection) // The requests of a connection are answered in order by one worker at a time. 
+	{
+		for (size_t lineCount = 0; lineCount < BATCH_LINE_COUNT; ++lineCount)
+		{
+			std::pair<std::string, TIME_POINT_TYPE> pendingLine{};
+			{
+				std::lock_guard<std::mutex> lock(connection->mutex);
+				if (connection->pendingLines.empty() || connection->sendingBuffer.size() >= MAXIMUM_SENDING_LENGTH) // The lines received before the peer closed are still answered. 
+				{
+					connection->isScheduled = false;
+					return;
+				}
+				pendingLine = std::move(connection->pendingLines.front());
+				connection->pendingLines.pop_front();
+			}
+			bool isClosing = false;
+			const std::string reply = this->handle(pendingLine.first, connection->advisor, isClosing);
+			{
+				std::lock_guard<std::mutex> lock(connection->mutex);
+				connection->sendingBuffer += reply + "\n";
+				if (!Server::flush(*connection))
+					Server::drop(*connection);
+				else if (isClosing)
+				{
+					connection->pendingLines.clear();
+					connection->isClosing = true;
+				}
+			}
+			const TIME_POINT_TYPE endTime = std::chrono::high_resolution_clock::now();
+			this->latencies.record(std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - pendingLine.second).count());
+		}
+		this->schedule(connection); // The connection stays scheduled and waits behind the others. 
+		return;
+	}
+	void work()
+	{
+		for (;;)
+		{
+			std::shared_ptr<Connection> connection{};
+			{
+				std::unique_lock<std::mutex> lock(this->queueMutex);
+				this->queueCondition.wait(lock, [this]() { return this->isStopping || !this->scheduledConnections.empty(); });
+				if (this->isStopping)
+					return;
+				connection = this->scheduledConnections.front();
+				this->scheduledConnections.pop();
+			}
+			this->serve(connection);
+		}
+	}
+	void receive(const std::shared_ptr<Connection>& connection)
+	{
+		char receivingBuffer[4096] = { 0 };
+		const int length = recv(connection->clientSocket, receivingBuffer, sizeof(receivingBuffer), 0);
+		std::lock_guard<std::mutex> lock(connection->mutex);
+		if (length <= 0)
+		{
+			if (length < 0 && IS_WOULD_BLOCK())
+				return;
+			connection->isClosing = true;
+			return;
+		}
+		connection->receivingBuffer.append(receivingBuffer, static_cast<size_t>(length));
+		const TIME_POINT_TYPE receivingTime = std::chrono::high_resolution_clock::now();
+		for (size_t position = connection->receivingBuffer.find('\n'); position != std::string::npos; position = connection->receivingBuffer.find('\n'))
+		{
+			std::string line = connection->receivingBuffer.substr(0, position);
+			connection->receivingBuffer.erase(0, position + 1);
+			if (!line.empty() && '\r' == line.back())
+				line.pop_back();
+			connection->pendingLines.emplace_back(std::move(line), receivingTime);
+		}
+		if (connection->receivingBuffer.size() > MAXIMUM_LINE_LENGTH || connection->pendingLines.size() > MAXIMUM_PENDING_LINE_COUNT)
+			Server::drop(*connection);
+		else
+			this->resume(connection);
+		return;
+	}
+	void transmit(const std::shared_ptr<Connection>& connection)
+	{
+		std::lock_guard<std::mutex> lock(connection->mutex);
+		if (Server::flush(*connection))
+			this->resume(connection);
+		else
+			Server::drop(*connection);
+		return;
+	}
+	void release() // Closing connections are released once no worker holds them. 
+	{
+		for (std::map<SocketHandle, std::shared_ptr<Connection>>::iterator it = this->connections.begin(); it != this->connections.end();)
+		{
+			bool isReleasable = false;
+			{
+				std::lock_guard<std::mutex> lock(it->second->mutex);
+				isReleasable = it->second->isClosing && !it->second->isScheduled && it->second->pendingLines.empty() && it->second->sendingBuffer.empty();
+			}
+			if (isReleasable)
+			{
+				CLOSE_SOCKET(it->first);
+				it = this->connections.erase(it);
+			}
+			else
+				++it;
+		}
+		return;
+	}
+	bool claimPath(std::string& message) const // Only a stale socket left by a dead server may be replaced. 
+	{
+#if defined _WIN32 || defined _WIN64 || defined WIN32 || defined WIN64
+		const DWORD attributes = GetFileAttributesA(this->socketPath.c_str());
+		if (INVALID_FILE_ATTRIBUTES == attributes)
+			return true;
+		const bool isSocket = (attributes & FILE_ATTRIBUTE_REPARSE_POINT) && !(attributes & FILE_ATTRIBUTE_DIRECTORY);
+#else
+		struct stat fileStatus{};
+		if (lstat(this->socketPath.c_str(), &fileStatus))
+			return ENOENT == errno;
+		const bool isSocket = S_ISSOCK(fileStatus.st_mode);
+#endif
+		if (!isSocket)
+		{
+			message = "the path exists and is not a socket";
+			return false;
+		}
+		sockaddr_un address{};
+		address.sun_family = AF_UNIX;
+		std::copy(this->socketPath.begin(), this->socketPath.end(), address.sun_path);
+		const SocketHandle probingSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+		if (INVALID_SOCKET == probingSocket)
+		{
+			message = "the socket cannot be probed";
+			return false;
+		}
+		const bool isLive = !connect(probingSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address));
+		CLOSE_SOCKET(probingSocket);
+		if (isLive)
+		{
+			message = "another server is listening at the path";
+			return false;
+		}
+		else if (std::remove(this->socketPath.c_str()))
+		{
+			message = "the stale socket cannot be removed";
+			return false;
+		}
+		else
+			return true;
+	}
+	
+public:
+	Server(const FeedbackTable& feedbackTable, const std::string& path) : table(feedbackTable), socketPath(path)
+	{
+		
+	}
+	std::string getStatistics() const
+	{
+		return this->latencies.summarize();
+	}
+	bool run(const size_t workerCount, std::string& message)
+	{
+#if defined _WIN32 || defined _WIN64 || defined WIN32 || defined WIN64
+		WSADATA wsaData{};
+		if (WSAStartup(MAKEWORD(2, 2), &wsaData))
+		{
+			message = "Winsock cannot be started";
+			return false;
+		}
+#endif
+		sockaddr_un address{};
+		if (this->socketPath.empty() || this->socketPath.size() >= sizeof(address.sun_path))
+		{
+			message = "the path is empty or too long";
+			return false;
+		}
+		if (!this->claimPath(message))
+			return false;
+		address.sun_family = AF_UNIX;
+		std::copy(this->socketPath.begin(), this->socketPath.end(), address.sun_path);
+		this->listeningSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+		if (INVALID_SOCKET == this->listeningSocket)
+		{
+			message = "the socket cannot be created";
+			return false;
+		}
+		if (bind(this->listeningSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) || listen(this->listeningSocket, SOMAXCONN))
+		{
+			CLOSE_SOCKET(this->listeningSocket);
+			message = "the socket cannot be bound";
+			return false;
+		}
+		std::vector<std::thread> workers{};
+		for (size_t idx = 0; idx < workerCount; ++idx)
+			workers.emplace_back(&Server::work, this);
+		std::vector<PollDescriptor> descriptors{};
+		std::vector<std::shared_ptr<Connection>> polledConnections{};
+		while (!this->isStopping)
+		{
+			this->release();
+			descriptors.assign(1, PollDescriptor{});
+			descriptors[0].fd = this->listeningSocket;
+			descriptors[0].events = POLLIN;
+			polledConnections.clear();
+			for (const std::pair<const SocketHandle, std::shared_ptr<Connection>>& connection : this->connections)
+			{
+				std::lock_guard<std::mutex> lock(connection.second->mutex);
+				short events = 0;
+				if (!connection.second->isClosing && connection.second->pendingLines.size() < PAUSING_LINE_COUNT && connection.second->sendingBuffer.size() < MAXIMUM_SENDING_LENGTH)
+					events |= POLLIN;
+				if (!connection.second->sendingBuffer.empty())
+					events |= POLLOUT;
+				if (events)
+				{
+					descriptors.push_back(PollDescriptor{});
+					descriptors.back().fd = connection.first;
+					descriptors.back().events = events;
+					polledConnections.push_back(connection.second);
+				}
+			}
+			if (POLL(descriptors.data(), static_cast<PollCount>(descriptors.size()), 100) <= 0) // The flag is checked at least every 100 milliseconds. 
+				continue;
+			for (size_t idx = 1; idx < descriptors.size(); ++idx)
+			{
+				if ((descriptors[idx].events & POLLIN) && (descriptors[idx].revents & (POLLIN | POLLHUP | POLLERR)))
+					this->receive(polledConnections[idx - 1]);
+				if ((descriptors[idx].events & POLLOUT) && (descriptors[idx].revents & (POLLOUT | POLLHUP | POLLERR)))
+					this->transmit(polledConnections[idx - 1]);
+			}
+			if (descriptors[0].revents & POLLIN)
+			{
+				const SocketHandle clientSocket = accept(this->listeningSocket, nullptr, nullptr);
+				if (clientSocket != INVALID_SOCKET)
+				{
+					if (Server::setNonBlocking(clientSocket))
+						this->connections.emplace(clientSocket, std::make_shared<Connection>(clientSocket, this->table));
+					else
+						CLOSE_SOCKET(clientSocket);
+				}
+			}
+		}
+		{
+			std::lock_guard<std::mutex> lock(this->queueMutex);
+			this->queueCondition.notify_all();
+		}
+		for (std::thread& worker : workers)
+			worker.join();
+		for (const std::pair<const SocketHandle, std::shared_ptr<Connection>>& connection : this->connections)
+			CLOSE_SOCKET(connection.first);
+		this->connections.clear();
+		CLOSE_SOCKET(this->listeningSocket);
+		std::remove(this->socketPath.c_str());
+#if defined _WIN32 || defined _WIN64 || defined WIN32 || defined WIN64
+		WSACleanup();
+#endif
+		return true;
+	}
+};
+
 class Helper
 {
 public:
@@ -528,7 +1409,11 @@ public:
 		std::cout << "2) If a value $x$ satisfying $1.5 \\leqslant x < 4095.5$ is passed, the program will solve $\\left\\lfloor x + \\cfrac{1}{2}\\right\\rfloor$ random groups. " << std::endl;
 		std::cout << "3) If a value $x$ satisfying $x \\geqslant 4095.5$ is passed, the program will traverse all the 4096 groups. " << std::endl;
 		std::cout << "4) If one or more groups of 4 integers within the interval $[0, 7]$ are passed, the program will solve specifically. " << std::endl;
-		std::cout << "5) Otherwise, this help information will display. " << std::endl << std::endl;
+		std::cout << "5) If ``--feedback`` is passed, the program will print the packed results of all the 4096 $\\times$ 4096 (password, submission) pairs for cross-checking. " << std::endl;
+		std::cout << "6) If ``--solutions`` is passed, the program will print the solving results of all the 4096 groups for cross-checking. " << std::endl;
+		std::cout << "7) If ``--server`` is passed with an optional socket path, the program will serve requests over a Unix domain socket until ``SHUTDOWN`` is received. " << std::endl;
+		std::cout << "8) If ``--histogram`` is passed, the program will benchmark the pattern histograms of all the 4096 submissions against all the 4096 passwords. " << std::endl;
+		std::cout << "9) Otherwise, this help information will display. " << std::endl << std::endl;
 		return;
 	}
 };
@@ -538,9 +1423,170 @@ public:
 int main(int argc, char* argv[])
 {
 	Count groupCount = 0, successCount = 0, failureCount = 0, invalidityCount = 0, totalAttemptCount = 0;
+	bool isSolving = true; // The modes not solving any groups only use the counters for the error level and skip the attempt summary. 
 	Problem problem{};
 	std::chrono::nanoseconds totalTime = static_cast<std::chrono::nanoseconds>(0);
-	if (2 == argc)
+	if ((2 == argc || 3 == argc) && std::string("--server") == argv[1])
+	{
+		/* Each request is a line of ``SUBMIT``, ``RESET``, ``UPDATE``, ``SUGGEST``, ``STATS``, ``QUIT``, or ``SHUTDOWN`` answered by a line starting with ``OK`` or ``ERROR``. */
+		const std::string socketPath = 3 == argc ? argv[2] : DEFAULT_SOCKET_PATH;
+		const size_t workerCount = std::thread::hardware_concurrency() >= 1 ? std::thread::hardware_concurrency() : 4; // The workers take requests rather than connections. 
+		const TIME_POINT_TYPE startTime = std::chrono::high_resolution_clock::now();
+		const FeedbackTable table{};
+		const TIME_POINT_TYPE endTime = std::chrono::high_resolution_clock::now();
+		std::cout << "The tables have been loaded in " << std::to_string(std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count()) << " nanoseconds. " << std::endl;
+		std::cout << "The program is serving at \"" << socketPath << "\" with " << std::to_string(workerCount) << " " << (workerCount > 1 ? "workers" : "worker") << ". " << std::endl;
+		Server server(table, socketPath);
+		isSolving = false;
+		groupCount = 1;
+		std::string message{};
+		if (server.run(workerCount, message))
+		{
+			std::cout << "The server has stopped, and the request latencies are " << server.getStatistics() << ". " << std::endl;
+			++successCount;
+		}
+		else
+		{
+			std::cout << "The server failed to listen at \"" << socketPath << "\" since " << message << ". " << std::endl;
+			++failureCount;
+		}
+	}
+	else if (2 == argc && std::string("--histogram") == argv[1])
+	{
+		/* The table-driven kernel reads one pattern byte from the table and one code from the passwords per pair, and the throughput in GB/s counts these bytes. */
+		constexpr const Count roundCount = 8;
+		std::vector<Code> codes(CODE_COUNT);
+		for (Code code = 0; code < CODE_COUNT; ++code)
+			codes[code] = code;
+		std::vector<Histogram::Bins> expectedHistograms(CODE_COUNT, Histogram::Bins{}), histograms{};
+		for (Code submission = 0; submission < CODE_COUNT; ++submission)
+			for (Code password = 0; password < CODE_COUNT; ++password)
+				++expectedHistograms[submission][Feedback::evaluateDirectly(password, submission)];
+		const FeedbackTable table{};
+		std::cout << "The program has entered the histogram mode with " << std::to_string(std::thread::hardware_concurrency()) << " hardware " << (std::thread::hardware_concurrency() > 1 ? "threads" : "thread") << ". " << std::endl;
+		isSolving = false;
+		groupCount = roundCount << 1;
+		for (const FeedbackTable* const feedbackTable : { static_cast<const FeedbackTable*>(nullptr), &table })
+		{
+			Count matchCount = 0, mismatchCount = 0, invalidCount = 0;
+			std::chrono::nanoseconds bestTime = std::chrono::nanoseconds::max();
+			for (Count round = 0; round < roundCount; ++round)
+			{
+				const TIME_POINT_TYPE startTime = std::chrono::high_resolution_clock::now();
+				const bool isValid = Histogram::compute(codes, codes, histograms, 0, feedbackTable);
+				const TIME_POINT_TYPE endTime = std::chrono::high_resolution_clock::now();
+				if (!isValid)
+					++invalidCount;
+				else if (histograms == expectedHistograms)
+				{
+					++matchCount;
+					if (endTime - startTime < bestTime)
+						bestTime = endTime - startTime;
+				}
+				else
+					++mismatchCount;
+			}
+			successCount += matchCount;
+			failureCount += mismatchCount;
+			invalidityCount += invalidCount;
+			std::cout << "The " << (feedbackTable ? "table-driven" : "computing") << " kernel has conducted " << std::to_string(roundCount) << " rounds, where " << std::to_string(matchCount) << " matched the reference histograms, " << std::to_string(mismatchCount) << " mismatched, and " << std::to_string(invalidCount) << " " << (invalidCount > 1 ? "were" : "was") << " invalid. " << std::endl;
+			if (matchCount >= 1)
+			{
+				const long double seconds = static_cast<long double>(bestTime.count()) / 1000000000;
+				const long double pairCount = static_cast<long double>(CODE_COUNT) * CODE_COUNT;
+				std::cout << "The best round took " << std::to_string(bestTime.count()) << " nanoseconds, i.e., " << std::to_string(CODE_COUNT / seconds) << " guesses/s and " << std::to_string(pairCount / seconds) << " pairs/s";
+				if (feedbackTable)
+					std::cout << ", reading " << std::to_string(pairCount * (sizeof(Pattern) + sizeof(Code)) / seconds / 1000000000) << " GB/s";
+				std::cout << ". " << std::endl;
+			}
+		}
+	}
+	else if (2 == argc && std::string("--feedback") == argv[1])
+	{
+		/* Each line holds a password followed by the results of all the 4096 submissions as two hexadecimal digits per pattern. */
+		static const char hexDigits[] = "0123456789abcdef";
+		std::chrono::nanoseconds elapsedTime = static_cast<std::chrono::nanoseconds>(0);
+		unsigned long int disagreementCount = 0;
+		std::string lineBuffer{};
+		Status status = Status::Initialized;
+		std::vector<Result> results{};
+		std::vector<std::vector<Symbol>> groups(CODE_COUNT);
+		for (Code code = 0; code < CODE_COUNT; ++code)
+			groups[code] = Codec::decode(code);
+		std::cout << "The program has entered the feedback mode. " << std::endl;
+		isSolving = false;
+		groupCount = CODE_COUNT;
+		for (Code password = 0; password < CODE_COUNT; ++password)
+		{
+			bool isValid = true;
+			lineBuffer = Codec::toString(password) + ": ";
+			const TIME_POINT_TYPE startTime = std::chrono::high_resolution_clock::now();
+			for (Code submission = 0; submission < CODE_COUNT; ++submission)
+				if (problem.set(groups[password]) && problem.submit(groups[submission], status, results))
+				{
+					const Pattern pattern = Codec::encode(results);
+					lineBuffer.push_back(hexDigits[pattern >> 4]);
+					lineBuffer.push_back(hexDigits[pattern & 0x0F]);
+				}
+				else
+				{
+					lineBuffer += "--";
+					isValid = false;
+				}
+			const TIME_POINT_TYPE endTime = std::chrono::high_resolution_clock::now();
+			elapsedTime += endTime - startTime;
+			for (Code submission = 0; submission < CODE_COUNT; ++submission) // This untimed pass checks the generated tables against the step-by-step rule. 
+				if (Feedback::evaluate(password, submission) != Feedback::evaluateDirectly(password, submission))
+				{
+					++disagreementCount;
+					isValid = false;
+				}
+			std::cout << lineBuffer << std::endl;
+			if (isValid)
+				++successCount;
+			else
+				++invalidityCount;
+		}
+		std::cout << "The program has evaluated " << std::to_string(static_cast<unsigned long>(CODE_COUNT) * CODE_COUNT) << " pairs in " << std::to_string(elapsedTime.count()) << " nanoseconds, where " << std::to_string(invalidityCount) << " " << (invalidityCount > 1 ? "groups were" : "group was") << " invalid and " << std::to_string(disagreementCount) << " " << (disagreementCount > 1 ? "pairs disagreed" : "pair disagreed") << " between the table-driven and the step-by-step feedback. " << std::endl;
+	}
+	else if (2 == argc && std::string("--solutions") == argv[1])
+	{
+		/* Each line holds a password followed by the attempt count and the answer, ``Failed``, or ``Invalid``. */
+		std::chrono::nanoseconds elapsedTime = static_cast<std::chrono::nanoseconds>(0);
+		std::cout << "The program has entered the solution mode. " << std::endl;
+		groupCount = CODE_COUNT;
+		for (Code password = 0; password < CODE_COUNT; ++password)
+		{
+			problem.set(Codec::decode(password));
+			Count attemptCount = 0;
+			std::vector<Symbol> answers{};
+			const TIME_POINT_TYPE startTime = std::chrono::high_resolution_clock::now();
+			const bool isValid = Solver::solve(problem, attemptCount, answers);
+			const TIME_POINT_TYPE endTime = std::chrono::high_resolution_clock::now();
+			elapsedTime += endTime - startTime;
+			std::cout << Codec::toString(password) << ": " << std::to_string(attemptCount) << " -> ";
+			if (isValid)
+				if (answers.empty())
+				{
+					std::cout << "Failed" << std::endl;
+					++failureCount;
+				}
+				else
+				{
+					std::cout << Codec::toString(Codec::encode(answers)) << std::endl;
+					++successCount;
+					totalAttemptCount += attemptCount;
+					totalTime += endTime - startTime;
+				}
+			else
+			{
+				std::cout << "Invalid" << std::endl;
+				++invalidityCount;
+			}
+		}
+		std::cout << "The program has solved 4096 groups in " << std::to_string(elapsedTime.count()) << " nanoseconds, where " << std::to_string(successCount) << " succeeded, " << std::to_string(failureCount) << " failed, and " << std::to_string(invalidityCount) << " " << (invalidityCount > 1 ? "were" : "was") << " invalid. " << std::endl;
+	}
+	else if (2 == argc)
 	{
 		std::string argv1(argv[1]);
 		std::transform(argv1.begin(), argv1.end(), argv1.begin(), [](const char ch) { return 'A' <= ch && ch <= 'Z' ? static_cast<char>(ch | 0x20) : ch; });
@@ -724,7 +1770,7 @@ int main(int argc, char* argv[])
 	}
 	else
 		Helper::printHelp();
-	if (successCount >= 1)
+	if (isSolving && successCount >= 1)
 	{
 		const long double averageTime = static_cast<long double>(totalTime.count()) / successCount;
 		std::cout << "Among the successful groups, the average attempt count is " << std::to_string(totalAttemptCount) << " / " << std::to_string(successCount) << " = " << std::to_string(static_cast<long double>(totalAttemptCount) / successCount) << ", and the average time is " << std::to_string(totalTime.count()) << " / " << std::to_string(successCount) << " = " << std::to_string(averageTime) << " " << (averageTime > 1 ? "nanoseconds" : "nanosecond")  << ". " << std::endl;